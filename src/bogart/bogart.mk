@@ -11,6 +11,7 @@ TARGET   := bogart
 SOURCES  := bogart.C \
             AS_BAT_AssemblyGraph.C \
             AS_BAT_BestOverlapGraph.C \
+            AS_BAT_Checkpoint.C \
             AS_BAT_ChunkGraph.C \
             AS_BAT_CreateUnitigs.C \
             AS_BAT_Instrumentation.C \
@@ -26,6 +27,7 @@ SOURCES  := bogart.C \
             AS_BAT_ReadInfo.C \
             AS_BAT_SetParentAndHang.C \
             AS_BAT_SplitDiscontinuous.C \
+            AS_BAT_Sweep.C \
             AS_BAT_TigGraph.C \
             AS_BAT_TigVector.C \
             AS_BAT_Unitig.C \
@@ -54,6 +54,7 @@ SOURCES      := AS_global.C \
                 stores/gkStoreEncode.C \
                 \
                 stores/ovOverlap.C \
+                stores/ovOverlapSort.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
@@ -133,6 +134,7 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
                 stores/ovStoreIndexer.mk \
+                stores/ovStoreMerge.mk \
                 stores/ovStoreDump.mk \
                 stores/ovStoreStats.mk \
                 stores/tgStoreCompress.mk \
@@ -153,8 +155,11 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 overlapInCore/overlapConvert.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
+                overlapInCore/overlapInCoreHashBench.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
+                overlapInCore/liboverlap/prefixEditDistance-kernelCheck.mk \
+                overlapInCore/libedlib/edlib-workspaceBench.mk \
                 \
                 mhap/mhap.mk \
                 mhap/mhapConvert.mk \
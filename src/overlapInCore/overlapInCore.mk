@@ -10,6 +10,8 @@ endif
 TARGET   := overlapInCore
 SOURCES  := overlapInCore.C \
             overlapInCore-Build_Hash_Index.C \
+            overlapInCore-Hash_Index_File.C \
+            overlapInCore-Minimizers.C \
             overlapInCore-Find_Overlaps.C \
             overlapInCore-Output.C \
             overlapInCore-Process_Overlaps.C \
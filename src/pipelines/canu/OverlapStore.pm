@@ -83,6 +83,7 @@ sub createOverlapStoreSequential ($$$$) {
     $cmd .= " -O $wrk/$asm.ovlStore.BUILDING \\\n";
     $cmd .= " -G $wrk/$asm.gkpStore \\\n";
     $cmd .= " -M $memSize \\\n";
+    $cmd .= " -t " . getGlobal("ovsThreads") . " \\\n";
     $cmd .= " -L $files \\\n";
     $cmd .= " > $wrk/$asm.ovlStore.err 2>&1";
 
@@ -283,6 +284,7 @@ sub overlapStoreConfigure ($$$$) {
         print F "\$bin/ovStoreSorter \\\n";
         print F "  -deletelate \\\n";  #  Choices -deleteearly -deletelate or nothing
         print F "  -M $memLimit \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -O $wrk/$asm.ovlStore.BUILDING \\\n";
         print F "  -G $wrk/$asm.gkpStore \\\n";
         print F "  -F $numSlices \\\n";